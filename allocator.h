@@ -6,11 +6,23 @@
 
 #define ALIGNMENT 8
 
+// Requests whose size, rounded up to ALIGNMENT, reaches this count as large in two-ended placement
+#define LARGE_REQUEST_THRESHOLD 256
+
+// Placement strategies for choosing and carving free blocks
+typedef enum {
+    PLACEMENT_BEST_FIT,   // Smallest fitting block, allocation at its low end
+    PLACEMENT_TWO_ENDED   // Small requests from the low end, large from the high end
+} placement_mode;
+
 // Function declarations
 bool myinit(void *heap_start, size_t heap_size);
 void *mymalloc(size_t requested_size);
 void myfree(void *ptr);
 void *myrealloc(void *old_ptr, size_t new_size);
+void set_placement_mode(placement_mode mode);
+size_t total_free_memory();
+size_t largest_free_block();
 bool validate_heap();
 void dump_heap();
 
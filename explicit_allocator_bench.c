@@ -0,0 +1,197 @@
+#include "allocator.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Fragmentation benchmark comparing placement modes on long churn runs.
+ * The workload mixes transient small blocks, long-lived small survivors and
+ * large blocks, which is the pattern where small survivors scattered through
+ * the heap trap large free gaps. Every mode replays the same request streams
+ * from a fixed set of seeds. After each run everything is freed to check
+ * that the heap merges back into a single free block.
+ */
+
+#define HEAP_SIZE (1024 * 1024)  // 1MB heap
+#define CHURN_STEPS 200000
+#define SAMPLE_INTERVAL 1000
+
+#define TRANSIENT_SLOTS 1024
+#define SURVIVOR_SLOTS 512
+#define LARGE_SLOTS 100
+
+#define SMALL_MIN 16
+#define SMALL_MAX 128
+#define LARGE_MIN 2048
+#define LARGE_MAX 16384
+
+static const unsigned int seeds[] = {1, 7, 42, 1234, 2024};
+#define SEED_COUNT (sizeof(seeds) / sizeof(seeds[0]))
+
+typedef struct bench_result {
+    size_t large_attempts;
+    size_t large_failures;
+    double avg_fragmentation;
+    double max_fragmentation;
+    size_t min_largest_free;
+    size_t end_largest_free;  // Largest free block once everything is freed
+    size_t end_total_free;    // Total free memory once everything is freed
+} bench_result;
+
+void *heap;
+void *transient[TRANSIENT_SLOTS];
+void *survivors[SURVIVOR_SLOTS];
+void *large[LARGE_SLOTS];
+
+size_t random_size(size_t min, size_t max) {
+    return min + (size_t)rand() % (max - min + 1);
+}
+
+/*
+ * Toggles a slot: allocates the given size if it is empty, frees it otherwise.
+ * Returns false only when an allocation was attempted and failed.
+ */
+bool toggle_slot(void **slot, size_t sz) {
+    if (*slot != NULL) {
+        myfree(*slot);
+        *slot = NULL;
+        return true;
+    }
+    *slot = mymalloc(sz);
+    if (*slot == NULL) {
+        return false;
+    }
+    memset(*slot, 0xAB, sz);
+    return true;
+}
+
+/*
+ * External fragmentation: the share of free memory that is not usable by a
+ * single request of the largest possible size.
+ */
+double fragmentation() {
+    size_t free_bytes = total_free_memory();
+    if (free_bytes == 0) {
+        return 0.0;
+    }
+    return 1.0 - (double)largest_free_block() / (double)free_bytes;
+}
+
+/*
+ * Frees every live block in a slot array.
+ */
+void free_slots(void **slots, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (slots[i] != NULL) {
+            myfree(slots[i]);
+            slots[i] = NULL;
+        }
+    }
+}
+
+bench_result run_churn(placement_mode mode, unsigned int seed) {
+    bench_result result = {0, 0, 0.0, 0.0, HEAP_SIZE, 0, 0};
+    size_t samples = 0;
+
+    memset(transient, 0, sizeof(transient));
+    memset(survivors, 0, sizeof(survivors));
+    memset(large, 0, sizeof(large));
+
+    set_placement_mode(mode);
+    if (!myinit(heap, HEAP_SIZE)) {
+        printf("Failed to initialize heap\n");
+        exit(1);
+    }
+    srand(seed);
+
+    for (int i = 0; i < CHURN_STEPS; i++) {
+        int kind = rand() % 100;
+
+        if (kind < 70) {
+            // Short-lived small blocks
+            int index = rand() % TRANSIENT_SLOTS;
+            toggle_slot(&transient[index], random_size(SMALL_MIN, SMALL_MAX));
+        } else if (kind < 75) {
+            // Small blocks that stay around for a long time
+            int index = rand() % SURVIVOR_SLOTS;
+            size_t sz = random_size(SMALL_MIN, SMALL_MAX);
+            if (survivors[index] == NULL || rand() % 8 == 0) {
+                toggle_slot(&survivors[index], sz);
+            }
+        } else {
+            // Large blocks
+            int index = rand() % LARGE_SLOTS;
+            size_t sz = random_size(LARGE_MIN, LARGE_MAX);
+            if (large[index] == NULL) {
+                result.large_attempts++;
+            }
+            if (!toggle_slot(&large[index], sz)) {
+                result.large_failures++;
+            }
+        }
+
+        if (i % SAMPLE_INTERVAL == 0) {
+            double frag = fragmentation();
+            size_t largest = largest_free_block();
+            result.avg_fragmentation += frag;
+            if (frag > result.max_fragmentation) {
+                result.max_fragmentation = frag;
+            }
+            if (largest < result.min_largest_free) {
+                result.min_largest_free = largest;
+            }
+            samples++;
+        }
+    }
+
+    if (!validate_heap()) {
+        printf("Heap validation failed after churn\n");
+        exit(1);
+    }
+
+    result.avg_fragmentation /= samples;
+
+    free_slots(transient, TRANSIENT_SLOTS);
+    free_slots(survivors, SURVIVOR_SLOTS);
+    free_slots(large, LARGE_SLOTS);
+    result.end_largest_free = largest_free_block();
+    result.end_total_free = total_free_memory();
+
+    set_placement_mode(PLACEMENT_BEST_FIT);
+    return result;
+}
+
+void print_result(const char *name, unsigned int seed, bench_result result) {
+    printf("%-10s %6u %8zu %8zu %9.2f%% %9.2f%% %9.2f%% %12zu %12zu %12zu\n",
+           name,
+           seed,
+           result.large_attempts,
+           result.large_failures,
+           100.0 * result.large_failures / result.large_attempts,
+           100.0 * result.avg_fragmentation,
+           100.0 * result.max_fragmentation,
+           result.min_largest_free,
+           result.end_largest_free,
+           result.end_total_free);
+}
+
+int main() {
+    heap = malloc(HEAP_SIZE);
+    if (heap == NULL) {
+        printf("Failed to allocate memory for benchmark heap\n");
+        return 1;
+    }
+
+    printf("Churn benchmark: %d steps on a %d byte heap\n", CHURN_STEPS, HEAP_SIZE);
+    printf("%-10s %6s %8s %8s %10s %10s %10s %12s %12s %12s\n",
+           "mode", "seed", "large", "failed", "fail rate", "avg frag", "max frag",
+           "min largest", "end largest", "end free");
+
+    for (size_t i = 0; i < SEED_COUNT; i++) {
+        print_result("best-fit", seeds[i], run_churn(PLACEMENT_BEST_FIT, seeds[i]));
+        print_result("two-ended", seeds[i], run_churn(PLACEMENT_TWO_ENDED, seeds[i]));
+    }
+
+    free(heap);
+    return 0;
+}
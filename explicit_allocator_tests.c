@@ -18,10 +18,18 @@ void test_realloc_edge_cases();
 void test_validate_heap();
 void test_mixed_operations();
 void test_fragmentation();
-void stress_test();
+void test_two_ended_placement();
+void test_two_ended_large_merge();
+size_t uniform_alloc_size();
+size_t mixed_alloc_size();
+void check_block_contents(void *ptr, size_t size, int index);
+void stress_test(placement_mode mode, size_t (*next_size)());
 
 // Global variables for testing
 #define HEAP_SIZE (1024 * 1024)  // 1MB heap
+#define HEADER_SIZE 16           // Size of a block header
+#define MAX_ALLOCATIONS 1000
+#define MAX_ALLOC_SIZE 1024
 void *test_heap;
 
 int main() {
@@ -48,7 +56,10 @@ int main() {
     test_validate_heap();
     test_mixed_operations();
     test_fragmentation();
-    stress_test();
+    test_two_ended_placement();
+    test_two_ended_large_merge();
+    stress_test(PLACEMENT_BEST_FIT, uniform_alloc_size);
+    stress_test(PLACEMENT_TWO_ENDED, mixed_alloc_size);
     
     // Clean up
     free(test_heap);
@@ -418,15 +429,122 @@ void test_fragmentation() {
     printf("Fragmentation tests passed!\n");
 }
 
-void stress_test() {
-    printf("Running stress test...\n");
+void test_two_ended_placement() {
+    printf("Testing two-ended placement...\n");
+    
+    set_placement_mode(PLACEMENT_TWO_ENDED);
+    reset_heap();
+    
+    // Small requests come from the low end of the heap
+    void *small1 = mymalloc(32);
+    void *small2 = mymalloc(64);
+    assert(small1 != NULL && small2 != NULL);
+    assert((char *)small1 == (char *)test_heap + HEADER_SIZE);
+    assert(small2 > small1);
+    assert(validate_heap());
+    
+    // Large requests are carved off the high end, growing downwards
+    void *large1 = mymalloc(LARGE_REQUEST_THRESHOLD);
+    void *large2 = mymalloc(4096);
+    assert(large1 != NULL && large2 != NULL);
+    assert((char *)large1 + LARGE_REQUEST_THRESHOLD == (char *)test_heap + HEAP_SIZE);
+    assert(large2 < large1);
+    assert(large2 > small2);
+    assert(((size_t)large2 & (ALIGNMENT - 1)) == 0);
+    assert(validate_heap());
+    
+    // The middle of the heap stays one free region shared by both ends
+    assert(largest_free_block() == total_free_memory());
+    
+    // A freed small block is reused by the next small request
+    myfree(small1);
+    void *small3 = mymalloc(16);
+    assert(small3 == small1);
+    assert(validate_heap());
     
+    // A freed large block is reused by the next large request of its size
+    myfree(large2);
+    void *large3 = mymalloc(4096);
+    assert(large3 == large2);
+    assert(validate_heap());
+    
+    // The whole heap is still reachable once everything is freed
+    myfree(small2);
+    myfree(small3);
+    myfree(large1);
+    myfree(large3);
+    assert(validate_heap());
+    assert(largest_free_block() == total_free_memory());
+    
+    set_placement_mode(PLACEMENT_BEST_FIT);
+    
+    printf("Two-ended placement tests passed!\n");
+}
+
+void test_two_ended_large_merge() {
+    printf("Testing two-ended merging of large blocks...\n");
+    
+    set_placement_mode(PLACEMENT_TWO_ENDED);
     reset_heap();
     
-    #define MAX_ALLOCATIONS 1000
-    #define MAX_ALLOC_SIZE 1024
+    // Freeing the lower large block first leaves free space on its left only
+    void *large1 = mymalloc(8192);
+    void *large2 = mymalloc(8192);
+    assert(large1 != NULL && large2 != NULL);
+    myfree(large2);
+    assert(validate_heap());
+    assert(largest_free_block() == total_free_memory());
+    
+    myfree(large1);
+    assert(validate_heap());
+    assert(largest_free_block() == total_free_memory());
+    
+    // The entire heap is one free block again
+    void *whole = mymalloc(HEAP_SIZE - HEADER_SIZE);
+    assert(whole == (char *)test_heap + HEADER_SIZE);
+    myfree(whole);
+    
+    // A small block that grows large moves to the high end
+    void *small = mymalloc(64);
+    memset(small, 8, 64);
+    void *grown = myrealloc(small, 4096);
+    assert(grown != NULL && grown != small);
+    assert((char *)grown + 4096 == (char *)test_heap + HEAP_SIZE);
+    for (int i = 0; i < 64; i++) assert(((char*)grown)[i] == 8);
+    myfree(grown);
+    assert(validate_heap());
+    assert(largest_free_block() == total_free_memory());
+    
+    set_placement_mode(PLACEMENT_BEST_FIT);
+    
+    printf("Two-ended merging tests passed!\n");
+}
+
+size_t uniform_alloc_size() {
+    return rand() % MAX_ALLOC_SIZE + 1;
+}
+
+// Mostly small requests with some large ones, so both ends of the heap are used
+size_t mixed_alloc_size() {
+    if (rand() % 4 == 0) {
+        return rand() % (MAX_ALLOC_SIZE * 4) + LARGE_REQUEST_THRESHOLD;
+    }
+    return rand() % 128 + 1;
+}
+
+// Check that no other block overwrote the fill pattern of a live block
+void check_block_contents(void *ptr, size_t size, int index) {
+    for (size_t i = 0; i < size; i++) assert(((unsigned char*)ptr)[i] == (index & 0xFF));
+}
+
+void stress_test(placement_mode mode, size_t (*next_size)()) {
+    printf("Running stress test...\n");
+    
+    set_placement_mode(mode);
+    reset_heap();
     
     void *ptrs[MAX_ALLOCATIONS] = {NULL};
+    size_t sizes[MAX_ALLOCATIONS] = {0};
     
     // Perform random allocations, reallocations, and frees
     for (int i = 0; i < 5000; i++) {
@@ -436,9 +554,10 @@ void stress_test() {
         switch (operation) {
             case 0: // malloc
                 if (ptrs[index] == NULL) {
-                    size_t size = rand() % MAX_ALLOC_SIZE + 1;
+                    size_t size = next_size();
                     ptrs[index] = mymalloc(size);
                     if (ptrs[index] != NULL) {
+                        sizes[index] = size;
                         memset(ptrs[index], index & 0xFF, size);
                     }
                 }
@@ -446,16 +565,22 @@ void stress_test() {
                 
             case 1: // realloc
                 if (ptrs[index] != NULL) {
-                    size_t size = rand() % MAX_ALLOC_SIZE + 1;
+                    size_t size = next_size();
+                    check_block_contents(ptrs[index], sizes[index], index);
                     void *new_ptr = myrealloc(ptrs[index], size);
                     if (new_ptr != NULL) {
+                        // The data must survive both in-place and moving reallocations
+                        check_block_contents(new_ptr, size < sizes[index] ? size : sizes[index], index);
                         ptrs[index] = new_ptr;
+                        sizes[index] = size;
+                        memset(ptrs[index], index & 0xFF, size);
                     }
                 }
                 break;
                 
             case 2: // free
                 if (ptrs[index] != NULL) {
+                    check_block_contents(ptrs[index], sizes[index], index);
                     myfree(ptrs[index]);
                     ptrs[index] = NULL;
                 }
@@ -471,11 +596,18 @@ void stress_test() {
     // Clean up any remaining allocations
     for (int i = 0; i < MAX_ALLOCATIONS; i++) {
         if (ptrs[i] != NULL) {
+            check_block_contents(ptrs[i], sizes[i], i);
             myfree(ptrs[i]);
         }
     }
     
     assert(validate_heap());
     
+    // Freed blocks merge in both directions, so everything re-merges
+    assert(largest_free_block() == total_free_memory());
+    assert(total_free_memory() == HEAP_SIZE - HEADER_SIZE);
+    
+    set_placement_mode(PLACEMENT_BEST_FIT);
+    
     printf("Stress test passed!\n");
 }
\ No newline at end of file
@@ -9,6 +9,13 @@
  * The allocator uses a free list to manage free memory blocks and 
  * supports basic operations like initialization, allocation, deallocation, 
  * reallocation, and heap validation.
+ *
+ * Two placement modes are available. Best-fit picks the smallest free block
+ * that fits. Two-ended placement serves small requests from the lowest
+ * fitting block and carves large requests off the top of the highest fitting
+ * block, so long-lived small blocks do not pin down the space large blocks
+ * need and the untouched middle of the heap stays one shared free region.
+ * Freed blocks are merged with free neighbors on both sides in either mode.
  */
 
 // Header struct to store block size and allocation status
@@ -29,6 +36,7 @@ static void *start;            // Start of the heap segment
 static size_t size;            // Size of the heap segment
 static char *end;              // End of the heap segment
 static memory_block *first_free_block; // Pointer to the first free block in the free list
+static placement_mode placement = PLACEMENT_BEST_FIT; // Strategy used by mymalloc
 
 /*
  * Function: roundup
@@ -40,6 +48,23 @@ size_t roundup(size_t sz, size_t mult) {
     return (sz + mult - 1) & ~(mult - 1);
 }
 
+/*
+ * Function: remove_free_block
+ * ---------------------------
+ * Unlinks a block from the free list.
+ */
+void remove_free_block(memory_block *block) {
+    if (block->prev != NULL) {
+        block->prev->next = block->next;
+    } else {
+        first_free_block = block->next;
+    }
+
+    if (block->next != NULL) {
+        block->next->prev = block->prev;
+    }
+}
+
 /*
  * Function: split_block_if_poss
  * -----------------------------
@@ -75,6 +100,32 @@ void split_block_if_poss(memory_block *cur_block, size_t needed) {
     }
 }
 
+/*
+ * Function: split_block_from_end
+ * ------------------------------
+ * Carves an allocation of the needed size off the high end of a free block.
+ * The leftmost part stays in the free list with a reduced size, so only the
+ * new allocated block needs a header. Takes the whole block if it is too
+ * small to split. Returns the allocated block.
+ */
+memory_block *split_block_from_end(memory_block *cur_block, size_t needed) {
+    if (cur_block->hdr.size - needed >= sizeof(header) * 3) {
+        // Shrink the free block in place, leaving room for the cut block on its right
+        cur_block->hdr.size -= sizeof(header) + needed;
+
+        memory_block *cut_block = (memory_block *)((char *)cur_block + sizeof(header) + cur_block->hdr.size);
+        cut_block->hdr.size = needed;
+        cut_block->hdr.allocated = true;
+
+        return cut_block;
+    }
+
+    remove_free_block(cur_block);
+    cur_block->hdr.allocated = true;
+
+    return cur_block;
+}
+
 /*
  * Function: coalesce_right
  * ------------------------
@@ -84,20 +135,31 @@ void coalesce_right(memory_block *new_block) {
     memory_block *right_neighbor = (memory_block *)((char *)(new_block) + sizeof(header) + new_block->hdr.size);
     
     // Remove right neighbor from the free list
-    if (right_neighbor->prev != NULL) {
-        right_neighbor->prev->next = right_neighbor->next;
-    } else {
-        first_free_block = right_neighbor->next;
-    }
-
-    if (right_neighbor->next != NULL) {
-        right_neighbor->next->prev = right_neighbor->prev;
-    }
+    remove_free_block(right_neighbor);
 
     // Update the new block's size to include the right neighbor
     new_block->hdr.size += sizeof(header) + right_neighbor->hdr.size;
 }
 
+/*
+ * Function: find_free_left_neighbor
+ * ---------------------------------
+ * Returns the free block that ends exactly where the given block starts, or NULL.
+ * Blocks have no footers, so this scans the free list.
+ */
+memory_block *find_free_left_neighbor(memory_block *block) {
+    memory_block *cur_block = first_free_block;
+
+    while (cur_block != NULL) {
+        if ((char *)cur_block + sizeof(header) + cur_block->hdr.size == (char *)block) {
+            return cur_block;
+        }
+        cur_block = cur_block->next;
+    }
+
+    return NULL;
+}
+
 /*
  * Function: myinit
  * ----------------
@@ -124,11 +186,65 @@ bool myinit(void *heap_start, size_t heap_size) {
     return true;
 }
 
+/*
+ * Function: set_placement_mode
+ * ----------------------------
+ * Selects the placement strategy used by subsequent allocations.
+ * Both modes keep the same block layout and merge freed blocks the same way,
+ * so the mode may change at any time, even on a live heap.
+ */
+void set_placement_mode(placement_mode mode) {
+    placement = mode;
+}
+
+/*
+ * Function: find_best_fit
+ * -----------------------
+ * Returns the smallest free block that can hold the needed size, or NULL.
+ */
+memory_block *find_best_fit(size_t needed) {
+    memory_block *best_fit = NULL;
+    memory_block *cur_block = first_free_block;
+
+    while (cur_block != NULL) {
+        if (cur_block->hdr.size >= needed) {
+            if (best_fit == NULL || cur_block->hdr.size < best_fit->hdr.size) {
+                best_fit = cur_block;
+            }
+        }
+        cur_block = cur_block->next;
+    }
+
+    return best_fit;
+}
+
+/*
+ * Function: find_end_fit
+ * ----------------------
+ * Returns the fitting free block with the highest address if from_high is set,
+ * or the one with the lowest address otherwise. Returns NULL if none fits.
+ */
+memory_block *find_end_fit(size_t needed, bool from_high) {
+    memory_block *end_fit = NULL;
+    memory_block *cur_block = first_free_block;
+
+    while (cur_block != NULL) {
+        if (cur_block->hdr.size >= needed) {
+            if (end_fit == NULL || (from_high ? cur_block > end_fit : cur_block < end_fit)) {
+                end_fit = cur_block;
+            }
+        }
+        cur_block = cur_block->next;
+    }
+
+    return end_fit;
+}
+
 /*
  * Function: mymalloc
  * ------------------
  * Allocates a block of memory of the requested size.
- * Uses the first-fit strategy and splits the block if necessary.
+ * Chooses a free block according to the placement mode and splits it if necessary.
  */
 void *mymalloc(size_t requested_size) {
     if (requested_size == 0) {
@@ -139,50 +255,40 @@ void *mymalloc(size_t requested_size) {
     size_t minimum_allocation = ALIGNMENT * 2;
     size_t needed = (requested_size <= minimum_allocation) ? minimum_allocation : roundup(requested_size, ALIGNMENT);
 
-    memory_block *best_fit = NULL;
-    memory_block *cur_block = first_free_block;
-
-    // Iterate through the free list to find the best fit block
-    while (cur_block != NULL) {
-        if (cur_block->hdr.size >= needed) {
-            if (best_fit == NULL || cur_block->hdr.size < best_fit->hdr.size) {
-                best_fit = cur_block;
-            }
+    // Large requests in two-ended mode are carved off the top of the highest fitting block
+    if (placement == PLACEMENT_TWO_ENDED && needed >= LARGE_REQUEST_THRESHOLD) {
+        memory_block *high_fit = find_end_fit(needed, true);
+        if (high_fit == NULL) {
+            return NULL;
         }
-        cur_block = cur_block->next;
+        return (char *)split_block_from_end(high_fit, needed) + sizeof(header);
     }
 
+    memory_block *fit = (placement == PLACEMENT_TWO_ENDED) ? find_end_fit(needed, false) : find_best_fit(needed);
+
     // If no suitable block was found, return NULL
-    if (best_fit == NULL) {
+    if (fit == NULL) {
         return NULL;
     }
 
     // Split the block if possible
-    split_block_if_poss(best_fit, needed);
+    split_block_if_poss(fit, needed);
 
     // Remove the newly allocated block from the free list
-    if (best_fit->prev != NULL) {
-        best_fit->prev->next = best_fit->next;
-    } else {
-        first_free_block = best_fit->next;
-    }
-
-    if (best_fit->next != NULL) {
-        best_fit->next->prev = best_fit->prev;
-    }
+    remove_free_block(fit);
 
     // Allocate the block by updating its header
-    best_fit->hdr.allocated = true;
+    fit->hdr.allocated = true;
 
     // Return a pointer to the allocated memory
-    return (char *)(best_fit) + sizeof(header);
+    return (char *)(fit) + sizeof(header);
 }
 
 /*
  * Function: myfree
  * ----------------
  * Frees a previously allocated block and adds it back to the free list.
- * Coalesces with neighboring free blocks if possible.
+ * Coalesces with free neighbors on both sides.
  */
 void myfree(void *ptr) {
     if (ptr == NULL) {
@@ -211,6 +317,14 @@ void myfree(void *ptr) {
         coalesce_right(new_block);
         right_neighbor = (memory_block *)((char *)new_block + sizeof(header) + new_block->hdr.size);
     }
+
+    // Coalesce with the left neighbor if it is free
+    memory_block *left_neighbor = find_free_left_neighbor(new_block);
+    while (left_neighbor != NULL) {
+        coalesce_right(left_neighbor);
+        new_block = left_neighbor;
+        left_neighbor = find_free_left_neighbor(new_block);
+    }
 }
 
 /*
@@ -218,6 +332,8 @@ void myfree(void *ptr) {
  * -------------------
  * Reallocates a previously allocated block to a new size.
  * Tries to expand in place or allocates a new block and copies the data.
+ * In two-ended mode a small block that grows large is always moved, so that
+ * it ends up at the high end of the heap.
  */
 void *myrealloc(void *old_ptr, size_t new_size) {
     if (old_ptr == NULL) {
@@ -241,9 +357,13 @@ void *myrealloc(void *old_ptr, size_t new_size) {
         return old_ptr;
     }
 
+    // A small block growing large in two-ended mode must not expand into the low end
+    bool becomes_large = placement == PLACEMENT_TWO_ENDED &&
+                         cur_block->hdr.size < LARGE_REQUEST_THRESHOLD && needed >= LARGE_REQUEST_THRESHOLD;
+
     // Try to expand the current block by coalescing with the right neighbor
     memory_block *right_neighbor = (memory_block *)((char *)cur_block + sizeof(header) + cur_block->hdr.size);
-    while ((void *)right_neighbor != end && !right_neighbor->hdr.allocated) {
+    while (!becomes_large && (void *)right_neighbor != end && !right_neighbor->hdr.allocated) {
         coalesce_right(cur_block);
         if (cur_block->hdr.size >= needed) {
             split_block_if_poss(cur_block, needed);
@@ -263,6 +383,35 @@ void *myrealloc(void *old_ptr, size_t new_size) {
     return new_ptr;
 }
 
+/*
+ * Function: total_free_memory
+ * ---------------------------
+ * Returns the sum of the payload sizes of all free blocks.
+ */
+size_t total_free_memory() {
+    size_t total = 0;
+    for (memory_block *cur_block = first_free_block; cur_block != NULL; cur_block = cur_block->next) {
+        total += cur_block->hdr.size;
+    }
+    return total;
+}
+
+/*
+ * Function: largest_free_block
+ * ----------------------------
+ * Returns the payload size of the largest free block, i.e. the largest
+ * request that can currently succeed.
+ */
+size_t largest_free_block() {
+    size_t largest = 0;
+    for (memory_block *cur_block = first_free_block; cur_block != NULL; cur_block = cur_block->next) {
+        if (cur_block->hdr.size > largest) {
+            largest = cur_block->hdr.size;
+        }
+    }
+    return largest;
+}
+
 /*
  * Function: validate_heap
  * -----------------------